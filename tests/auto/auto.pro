@@ -13,4 +13,5 @@ SUBDIRS += fluidicmachinetest \
     funtionsTest \
     pythonPlugins \
     stopTest \
-    twinValves
+    twinValves \
+    scalingBenchmark
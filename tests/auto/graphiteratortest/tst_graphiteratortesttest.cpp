@@ -25,6 +25,9 @@ private:
 private Q_SLOTS:
     void emptyAvoidNodes();
     void fullAvoidNodes();
+
+    void benchmarkIterator();
+    void benchmarkIteratorAvoidNodes();
 };
 
 GraphiteratortestTest::GraphiteratortestTest()
@@ -98,6 +101,47 @@ void GraphiteratortestTest::fullAvoidNodes() {
     }
 }
 
+void GraphiteratortestTest::benchmarkIterator() {
+    try {
+        unordered_map<std::string, int> containerMap;
+        std::shared_ptr<MachineGraph> comlexValve = std::make_shared<MachineGraph>(makeComplexValveGraph(containerMap));
+
+        int startNode = containerMap["v"];
+        int visited = 0;
+        QBENCHMARK {
+            MachineGraphIterator it(startNode, comlexValve);
+            while(it.advance()) {
+                visited++;
+            }
+        }
+        QVERIFY(visited > 0);
+    } catch (std::exception & e) {
+        QFAIL(std::string("exception: " + std::string(e.what())).c_str());
+    }
+}
+
+void GraphiteratortestTest::benchmarkIteratorAvoidNodes() {
+    try {
+        unordered_map<std::string, int> containerMap;
+        std::shared_ptr<MachineGraph> comlexValve = std::make_shared<MachineGraph>(makeComplexValveGraph(containerMap));
+
+        std::unordered_set<int> nodesToAvoid;
+        nodesToAvoid.insert(containerMap["v"]);
+
+        int startNode = containerMap["p1"];
+        int visited = 0;
+        QBENCHMARK {
+            MachineGraphIterator it(startNode, comlexValve, nodesToAvoid);
+            while(it.advance()) {
+                visited++;
+            }
+        }
+        QVERIFY(visited > 0);
+    } catch (std::exception & e) {
+        QFAIL(std::string("exception: " + std::string(e.what())).c_str());
+    }
+}
+
 MachineGraph GraphiteratortestTest::makeComplexValveGraph(std::unordered_map<std::string, int> & containerMap) {
     MachineGraph mGraph;
     PluginConfiguration config;
@@ -152,7 +152,7 @@ void MachineFlowTest::testMachineFlow_T5() {
 }
 
 void MachineFlowTest::printStack(const MachineFlow::FlowsVector & flows, std::stringstream & stream) {
-    for (auto tuple: flows) {
+    for (const auto & tuple: flows) {
         for(auto id: std::get<0>(tuple)) {
             stream << id;
         }
@@ -0,0 +1,491 @@
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <QString>
+#include <QtTest>
+
+#include <fluidicmachinemodel/fluidicmachinemodel.h>
+#include <fluidicmachinemodel/machine_graph_utils/graphrulesgenerator.h>
+#include <fluidicmachinemodel/fluidicnode/valvenode.h>
+
+#include <commonmodel/functions/function.h>
+#include <commonmodel/functions/pumppluginfunction.h>
+#include <commonmodel/functions/valvepluginroutefunction.h>
+#include <commonmodel/plugininterface/pluginconfiguration.h>
+
+#include <constraintengine/prologtranslationstack.h>
+
+#include "stringpluginfactory.h"
+#include "stringtranslationstack.h"
+
+class ScalingBenchmarkTest : public QObject
+{
+    Q_OBJECT
+
+    typedef std::vector<std::unordered_set<int>> TL;
+
+public:
+    ScalingBenchmarkTest();
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void testSyntheticMachineShape();
+    void testSyntheticMachineInvalidParameters();
+
+    void ruleSetSize_data();
+    void ruleSetSize();
+
+    void benchmarkRulesGeneration_data();
+    void benchmarkRulesGeneration();
+
+    void benchmarkModelConstruction_data();
+    void benchmarkModelConstruction();
+
+    void benchmarkRouteSolve_data();
+    void benchmarkRouteSolve();
+
+private:
+    void addScalingRows();
+
+    std::string tubesToString(MachineGraph::GraphType::EdgeVectorPtr edges);
+    std::string makeExpectedRouteCommands(int reactors, int twinPairs, int routedReactor);
+    bool checkSolutions(const std::string & generated, const std::string & expected);
+
+    /*
+     * Builds a machine with "reactors" closed reactors. Every reactor is fed by its own selector valve of
+     * "valvePorts" ports through a pump. Selector port 0 goes to the pump, ports 1..mediaLines come from the
+     * shared media containers and the remaining ports come from per reactor auxiliary containers.
+     * The first "twinPairs" reactors drain through an outlet valve that is twin of their selector valve,
+     * the rest drain straight to their waste.
+     *
+     * Nodes are stored in nodesMap as: media_j, reactor_i, waste_i (reachable in selector position 1),
+     * wasteAlt_i (twin reactors only), aux_i_p, p_i, v_i and vOut_i.
+     */
+    std::shared_ptr<MachineGraph> makeSyntheticMachine(int reactors,
+                                                       int mediaLines,
+                                                       int valvePorts,
+                                                       int twinPairs,
+                                                       std::unordered_map<std::string, int> & nodesMap,
+                                                       std::shared_ptr<PluginAbstractFactory> factory);
+};
+
+ScalingBenchmarkTest::ScalingBenchmarkTest()
+{
+}
+
+void ScalingBenchmarkTest::testSyntheticMachineShape() {
+    try {
+        std::shared_ptr<PluginAbstractFactory> factory = NULL;
+
+        std::unordered_map<std::string, int> nodesMap;
+        std::shared_ptr<MachineGraph> mGraph = makeSyntheticMachine(3, 2, 4, 1, nodesMap, factory);
+
+        // 2 media + 3 wastes + 3 aux + 1 alternative waste
+        QVERIFY2(mGraph->getNumOpenContainers() == 9,
+                 std::string("Number of opens containers is not 9, received " + std::to_string(mGraph->getNumOpenContainers())).c_str());
+
+        for (int i = 0; i < 3; i++) {
+            std::string idx = std::to_string(i);
+            QVERIFY2(mGraph->isCloseContainer(nodesMap["reactor_" + idx]), std::string("reactor_" + idx + " is not close container").c_str());
+            QVERIFY2(mGraph->isOpenContainer(nodesMap["waste_" + idx]), std::string("waste_" + idx + " is not open container").c_str());
+            QVERIFY2(mGraph->isOpenContainer(nodesMap["aux_" + idx + "_3"]), std::string("aux_" + idx + "_3 is not open container").c_str());
+            QVERIFY2(mGraph->isPump(nodesMap["p_" + idx]), std::string("p_" + idx + " is not a pump").c_str());
+            QVERIFY2(mGraph->isValve(nodesMap["v_" + idx]), std::string("v_" + idx + " is not a valve").c_str());
+        }
+        QVERIFY2(mGraph->isValve(nodesMap["vOut_0"]), "vOut_0 is not a valve");
+        QVERIFY2(mGraph->isOpenContainer(nodesMap["wasteAlt_0"]), "wasteAlt_0 is not open container");
+        QVERIFY2(nodesMap.find("vOut_1") == nodesMap.end(), "reactor 1 must not have an outlet valve");
+
+        std::string media0 = std::to_string(nodesMap["media_0"]);
+        std::string media1 = std::to_string(nodesMap["media_1"]);
+        std::string aux0 = std::to_string(nodesMap["aux_0_3"]);
+        std::string v0 = std::to_string(nodesMap["v_0"]);
+        std::string p0 = std::to_string(nodesMap["p_0"]);
+        std::string reactor0 = std::to_string(nodesMap["reactor_0"]);
+        std::string vOut0 = std::to_string(nodesMap["vOut_0"]);
+        std::string waste0 = std::to_string(nodesMap["waste_0"]);
+        std::string wasteAlt0 = std::to_string(nodesMap["wasteAlt_0"]);
+
+        std::string expected = media0 + "->" + v0 + ";" + media1 + "->" + v0 + ";" + aux0 + "->" + v0 + ";";
+        std::string received = tubesToString(mGraph->getArrivingTubes(nodesMap["v_0"]));
+        QVERIFY2(expected.compare(received) == 0,
+                 std::string("Arriving edges to v_0 incorrect. spected=" + expected + ", received=" + received).c_str());
+
+        expected = v0 + "->" + p0 + ";";
+        received = tubesToString(mGraph->getLeavingTubes(nodesMap["v_0"]));
+        QVERIFY2(expected.compare(received) == 0,
+                 std::string("Leaving edges of v_0 incorrect. spected=" + expected + ", received=" + received).c_str());
+
+        expected = reactor0 + "->" + vOut0 + ";";
+        received = tubesToString(mGraph->getArrivingTubes(nodesMap["vOut_0"]));
+        QVERIFY2(expected.compare(received) == 0,
+                 std::string("Arriving edges to vOut_0 incorrect. spected=" + expected + ", received=" + received).c_str());
+
+        expected = vOut0 + "->" + waste0 + ";" + vOut0 + "->" + wasteAlt0 + ";";
+        received = tubesToString(mGraph->getLeavingTubes(nodesMap["vOut_0"]));
+        QVERIFY2(expected.compare(received) == 0,
+                 std::string("Leaving edges of vOut_0 incorrect. spected=" + expected + ", received=" + received).c_str());
+
+        expected = std::to_string(nodesMap["reactor_1"]) + "->" + std::to_string(nodesMap["waste_1"]) + ";";
+        received = tubesToString(mGraph->getLeavingTubes(nodesMap["reactor_1"]));
+        QVERIFY2(expected.compare(received) == 0,
+                 std::string("Leaving edges of reactor_1 incorrect. spected=" + expected + ", received=" + received).c_str());
+
+        // twin valves are only visible through the rules, the generator equals their positions
+        GraphRulesGenerator generator(mGraph, 3, 2);
+        StringTranslationStack translate;
+        for (const std::shared_ptr<Rule> & rule : generator.getRules()) {
+            rule->fillTranslationStack(&translate);
+            translate.addHeadToRestrictions();
+        }
+
+        std::string twinEquality = "V_" + v0 + "==V_" + vOut0;
+        bool twinFound = false;
+        for (const std::string & restriction : translate.getTranslatedRestriction()) {
+            twinFound = twinFound || (restriction.find(twinEquality) != std::string::npos);
+        }
+        QVERIFY2(twinFound, std::string("generated rules do not contain twin equality " + twinEquality).c_str());
+    } catch (std::exception & e) {
+        QFAIL(e.what());
+    }
+}
+
+void ScalingBenchmarkTest::testSyntheticMachineInvalidParameters() {
+    std::shared_ptr<PluginAbstractFactory> factory = NULL;
+    std::unordered_map<std::string, int> nodesMap;
+
+    try {
+        makeSyntheticMachine(0, 1, 2, 0, nodesMap, factory);
+        QFAIL("machine without reactors must fail!");
+    } catch (std::invalid_argument & ignored) {
+        QVERIFY(true);
+    }
+
+    try {
+        makeSyntheticMachine(2, 0, 2, 0, nodesMap, factory);
+        QFAIL("machine without media lines must fail!");
+    } catch (std::invalid_argument & ignored) {
+        QVERIFY(true);
+    }
+
+    try {
+        makeSyntheticMachine(2, 4, 4, 0, nodesMap, factory);
+        QFAIL("more media lines than selector inlets must fail!");
+    } catch (std::invalid_argument & ignored) {
+        QVERIFY(true);
+    }
+
+    try {
+        makeSyntheticMachine(2, 2, 4, 3, nodesMap, factory);
+        QFAIL("more twin pairs than reactors must fail!");
+    } catch (std::invalid_argument & ignored) {
+        QVERIFY(true);
+    }
+}
+
+void ScalingBenchmarkTest::ruleSetSize_data() {
+    addScalingRows();
+}
+
+void ScalingBenchmarkTest::ruleSetSize() {
+    QFETCH(int, reactors);
+    QFETCH(int, mediaLines);
+    QFETCH(int, valvePorts);
+    QFETCH(int, twinPairs);
+
+    try {
+        std::shared_ptr<PluginAbstractFactory> factory = NULL;
+
+        std::unordered_map<std::string, int> nodesMap;
+        std::shared_ptr<MachineGraph> machine = makeSyntheticMachine(reactors, mediaLines, valvePorts, twinPairs, nodesMap, factory);
+
+        GraphRulesGenerator generator(machine, 3, 2);
+
+        StringTranslationStack translate;
+        for (const std::shared_ptr<Rule> & rule : generator.getRules()) {
+            rule->fillTranslationStack(&translate);
+            translate.addHeadToRestrictions();
+        }
+
+        size_t translatedChars = 0;
+        for (const std::string & restriction : translate.getTranslatedRestriction()) {
+            translatedChars += restriction.length();
+        }
+
+        // memory is not measured directly, the translated rules size is used as a proxy of the rule set footprint
+        qDebug() << "reactors:" << reactors
+                 << "nodes:" << nodesMap.size()
+                 << "rules:" << generator.getRules().size()
+                 << "translated chars:" << translatedChars;
+
+        QVERIFY2(!generator.getRules().empty(), "no rules generated");
+    } catch (std::exception & e) {
+        QFAIL(e.what());
+    }
+}
+
+void ScalingBenchmarkTest::benchmarkRulesGeneration_data() {
+    addScalingRows();
+}
+
+void ScalingBenchmarkTest::benchmarkRulesGeneration() {
+    QFETCH(int, reactors);
+    QFETCH(int, mediaLines);
+    QFETCH(int, valvePorts);
+    QFETCH(int, twinPairs);
+
+    try {
+        std::shared_ptr<PluginAbstractFactory> factory = NULL;
+
+        std::unordered_map<std::string, int> nodesMap;
+        std::shared_ptr<MachineGraph> machine = makeSyntheticMachine(reactors, mediaLines, valvePorts, twinPairs, nodesMap, factory);
+
+        size_t rulesCount = 0;
+        QBENCHMARK {
+            GraphRulesGenerator generator(machine, 3, 2);
+            rulesCount = generator.getRules().size();
+        }
+        QVERIFY2(rulesCount > 0, "no rules generated");
+    } catch (std::exception & e) {
+        QFAIL(e.what());
+    }
+}
+
+void ScalingBenchmarkTest::benchmarkModelConstruction_data() {
+    addScalingRows();
+}
+
+void ScalingBenchmarkTest::benchmarkModelConstruction() {
+    QFETCH(int, reactors);
+    QFETCH(int, mediaLines);
+    QFETCH(int, valvePorts);
+    QFETCH(int, twinPairs);
+
+    try {
+        std::shared_ptr<StringPluginFactory> strFactory = std::make_shared<StringPluginFactory>();
+
+        std::unordered_map<std::string, int> nodesMap;
+        std::shared_ptr<MachineGraph> machine = makeSyntheticMachine(reactors, mediaLines, valvePorts, twinPairs, nodesMap, strFactory);
+
+        // includes rule generation, subtract benchmarkRulesGeneration to get the engine build time
+        QBENCHMARK {
+            std::shared_ptr<TranslationStack> prologTStack = std::make_shared<PrologTranslationStack>();
+            FluidicMachineModel model(machine, prologTStack, 3, 2, 300);
+        }
+    } catch (std::exception & e) {
+        QFAIL(e.what());
+    }
+}
+
+void ScalingBenchmarkTest::benchmarkRouteSolve_data() {
+    addScalingRows();
+}
+
+void ScalingBenchmarkTest::benchmarkRouteSolve() {
+    QFETCH(int, reactors);
+    QFETCH(int, mediaLines);
+    QFETCH(int, valvePorts);
+    QFETCH(int, twinPairs);
+
+    try {
+        std::shared_ptr<StringPluginFactory> strFactory = std::make_shared<StringPluginFactory>();
+
+        std::unordered_map<std::string, int> nodesMap;
+        std::shared_ptr<MachineGraph> machine = makeSyntheticMachine(reactors, mediaLines, valvePorts, twinPairs, nodesMap, strFactory);
+
+        std::shared_ptr<TranslationStack> prologTStack = std::make_shared<PrologTranslationStack>();
+        FluidicMachineModel model(machine, prologTStack, 3, 2, 300);
+
+        int lastReactor = reactors - 1;
+        int source = nodesMap["media_0"];
+        int reactor = nodesMap["reactor_" + std::to_string(lastReactor)];
+        int waste = nodesMap["waste_" + std::to_string(lastReactor)];
+
+        model.setContinuousFlow({source, reactor, waste}, 300 * units::ml/units::hr);
+        model.processFlows({});
+        model.stopContinuousFlow(source, waste);
+
+        std::string expected = makeExpectedRouteCommands(reactors, twinPairs, lastReactor);
+        std::string generated = strFactory->getCommandsSent();
+
+        qDebug() << "generated: " << generated.c_str();
+        qDebug() << "expected: " << expected.c_str();
+
+        QVERIFY2(checkSolutions(expected, generated), "expected and generated outputs are not the same check debug for more information");
+
+        QBENCHMARK {
+            model.setContinuousFlow({source, reactor, waste}, 300 * units::ml/units::hr);
+            model.processFlows({});
+            model.stopContinuousFlow(source, waste);
+            strFactory->getCommandsSent();
+        }
+    } catch (std::exception & e) {
+        QFAIL(e.what());
+    }
+}
+
+void ScalingBenchmarkTest::initTestCase() {
+    PrologExecutor::createEngine(std::string(QTest::currentAppName()));
+}
+
+void ScalingBenchmarkTest::cleanupTestCase() {
+    PrologExecutor::destoryEngine();
+}
+
+std::string ScalingBenchmarkTest::tubesToString(MachineGraph::GraphType::EdgeVectorPtr edges) {
+    std::stringstream stream;
+    for (std::shared_ptr<TubeEdge> e: *edges.get()) {
+        stream << std::to_string(e->getIdSource()) << "->" << std::to_string(e->getIdTarget()) << ";";
+    }
+    return stream.str();
+}
+
+std::string ScalingBenchmarkTest::makeExpectedRouteCommands(int reactors, int twinPairs, int routedReactor) {
+    std::stringstream stream;
+    for (int i = 0; i < reactors; i++) {
+        std::string idx = std::to_string(i);
+        if (i == routedReactor) {
+            stream << "SET PUMP P_" << idx << ": dir 1, rate 300ml/h;";
+            stream << "MOVE VALVE V_" << idx << " 1;";
+        } else {
+            stream << "SET PUMP P_" << idx << ": dir 0, rate 0ml/h;";
+            stream << "MOVE VALVE V_" << idx << " 0;";
+        }
+
+        if (i < twinPairs) {
+            stream << "MOVE VALVE VOUT_" << idx << " " << (i == routedReactor ? 1 : 0) << ";";
+        }
+    }
+    return stream.str();
+}
+
+bool ScalingBenchmarkTest::checkSolutions(const std::string & generated, const std::string & expected) {
+    std::vector<std::string> generatedTokens;
+    Utils::tokenize(generated, generatedTokens, ";");
+
+    std::vector<std::string> expectedTokens;
+    Utils::tokenize(expected, expectedTokens, ";");
+
+    std::unordered_set<std::string> generatedSet(generatedTokens.begin(), generatedTokens.end());
+    std::unordered_set<std::string> expectedSet(expectedTokens.begin(), expectedTokens.end());
+    return (generatedSet == expectedSet);
+}
+
+void ScalingBenchmarkTest::addScalingRows() {
+    QTest::addColumn<int>("reactors");
+    QTest::addColumn<int>("mediaLines");
+    QTest::addColumn<int>("valvePorts");
+    QTest::addColumn<int>("twinPairs");
+
+    QTest::newRow("1 reactor") << 1 << 2 << 4 << 1;
+    QTest::newRow("2 reactors") << 2 << 2 << 4 << 1;
+    QTest::newRow("4 reactors") << 4 << 2 << 4 << 2;
+    QTest::newRow("8 reactors") << 8 << 2 << 4 << 4;
+    QTest::newRow("4 reactors, 6 port valves") << 4 << 4 << 6 << 2;
+}
+
+std::shared_ptr<MachineGraph> ScalingBenchmarkTest::makeSyntheticMachine(int reactors,
+                                                                         int mediaLines,
+                                                                         int valvePorts,
+                                                                         int twinPairs,
+                                                                         std::unordered_map<std::string, int> & nodesMap,
+                                                                         std::shared_ptr<PluginAbstractFactory> factory)
+{
+    if (reactors < 1 || mediaLines < 1) {
+        throw std::invalid_argument("synthetic machine needs at least one reactor and one media line");
+    }
+    if (valvePorts < mediaLines + 1) {
+        throw std::invalid_argument("selector valves of " + std::to_string(valvePorts) + " ports cannot take " +
+                                    std::to_string(mediaLines) + " media lines");
+    }
+    if (twinPairs < 0 || twinPairs > reactors) {
+        throw std::invalid_argument("twin pairs must be between 0 and " + std::to_string(reactors));
+    }
+
+    std::shared_ptr<MachineGraph> mGraph = std::make_shared<MachineGraph>();
+
+    TL empty;
+
+    ValveNode::TruthTable selectorTable;
+    selectorTable.insert(std::make_pair(0, empty));
+    for (int position = 1; position < valvePorts; position++) {
+        selectorTable.insert(std::make_pair(position, TL({{0, position}})));
+    }
+
+    // same positions as the selector so both can be twins, alternating between the two wastes
+    ValveNode::TruthTable outletTable;
+    outletTable.insert(std::make_pair(0, empty));
+    for (int position = 1; position < valvePorts; position++) {
+        outletTable.insert(std::make_pair(position, TL({{0, 1 + ((position - 1) % 2)}})));
+    }
+
+    std::vector<int> media;
+    for (int j = 0; j < mediaLines; j++) {
+        int medium = mGraph->emplaceContainer(reactors, ContainerNode::open, 100.0);
+        media.push_back(medium);
+        nodesMap["media_" + std::to_string(j)] = medium;
+    }
+
+    for (int i = 0; i < reactors; i++) {
+        std::string idx = std::to_string(i);
+
+        PluginConfiguration config_p;
+        config_p.setName("P_" + idx);
+        std::shared_ptr<Function> pumpf = std::make_shared<PumpPluginFunction>(factory, config_p, PumpWorkingRange(0 * units::ml/units::hr, 999 * units::ml/units::hr));
+
+        PluginConfiguration config_v;
+        config_v.setName("V_" + idx);
+        std::shared_ptr<Function> route_v = std::make_shared<ValvePluginRouteFunction>(factory, config_v);
+
+        int reactor = mGraph->emplaceContainer(2, ContainerNode::close, 100.0);
+        int waste = mGraph->emplaceContainer(1, ContainerNode::open, 100.0);
+        int p = mGraph->emplacePump(2, PumpNode::unidirectional, pumpf);
+        int v = mGraph->emplaceValve(valvePorts, selectorTable, route_v);
+
+        nodesMap["reactor_" + idx] = reactor;
+        nodesMap["waste_" + idx] = waste;
+        nodesMap["p_" + idx] = p;
+        nodesMap["v_" + idx] = v;
+
+        for (int j = 0; j < mediaLines; j++) {
+            mGraph->connectNodes(media[j], v, i, j + 1);
+        }
+        for (int port = mediaLines + 1; port < valvePorts; port++) {
+            int aux = mGraph->emplaceContainer(1, ContainerNode::open, 100.0);
+            nodesMap["aux_" + idx + "_" + std::to_string(port)] = aux;
+
+            mGraph->connectNodes(aux, v, 0, port);
+        }
+
+        mGraph->connectNodes(v, p, 0, 0);
+        mGraph->connectNodes(p, reactor, 1, 0);
+
+        if (i < twinPairs) {
+            PluginConfiguration config_vOut;
+            config_vOut.setName("VOUT_" + idx);
+            std::shared_ptr<Function> route_vOut = std::make_shared<ValvePluginRouteFunction>(factory, config_vOut);
+
+            int wasteAlt = mGraph->emplaceContainer(1, ContainerNode::open, 100.0);
+            int vOut = mGraph->emplaceValve(3, outletTable, route_vOut);
+
+            nodesMap["wasteAlt_" + idx] = wasteAlt;
+            nodesMap["vOut_" + idx] = vOut;
+
+            mGraph->connectNodes(reactor, vOut, 1, 0);
+            mGraph->connectNodes(vOut, waste, 1, 0);
+            mGraph->connectNodes(vOut, wasteAlt, 2, 0);
+
+            mGraph->setValvesAsTwins({v, vOut});
+        } else {
+            mGraph->connectNodes(reactor, waste, 1, 0);
+        }
+    }
+    return mGraph;
+}
+
+QTEST_APPLESS_MAIN(ScalingBenchmarkTest)
+
+#include "tst_scalingbenchmarktest.moc"
@@ -35,7 +35,7 @@ void ZeroIteratorTest::checkZero()
         std::vector<std::string> calculated;
         while(it.calculateNext()) {
             const LabelCombinationsIterator::LabelTypeTubeMap & actual = it.getTubesLabelsMap();
-            for (auto tuple: actual) {
+            for (const auto & tuple: actual) {
                 stringstream stream;
                 const std::tuple<int,int> & tubeId = tuple.first;
                 Label label = tuple.second;
@@ -104,7 +104,7 @@ void ZeroIteratorTest::checkBiggerSmaller() {
         std::vector<std::string> calculated;
         while(it.calculateNext()) {
             const LabelCombinationsIterator::LabelTypeTubeMap & actual = it.getTubesLabelsMap();
-            for (auto tuple: actual) {
+            for (const auto & tuple: actual) {
                 stringstream stream;
                 const std::tuple<int,int> & tubeId = tuple.first;
                 Label label = tuple.second;